@@ -31,10 +31,12 @@ SOURCES += \
         JeVoisInventor.C \
         TopPanel.C \
         Serial.C \
+        SerialFramer.C \
         Console.C \
         CamControls.C \
         CfgEdit.C \
         CfgHighlighter.C \
+        LexHighlighter.C \
         Editor.C \
         CfgStack.C \
         Utils.C \
@@ -51,7 +53,12 @@ SOURCES += \
         RangeSlider.C \
         SpinSlider.C \
         SpinRangeSlider.C \
-        PreferencesDialog.C
+        PreferencesDialog.C \
+        ModuleCache.C \
+        LogModel.C \
+        Telemetry.C \
+        Stats.C \
+        Fleet.C
 
         
 #        VideoWidget.C
@@ -62,10 +69,12 @@ HEADERS += \
         JeVoisInventor.H \
         TopPanel.H \
         Serial.H \
+        SerialFramer.H \
         Console.H \
         CamControls.H \
         CfgEdit.H \
         CfgHighlighter.H \
+        LexHighlighter.H \
         Editor.H \
         CfgStack.H \
         Utils.H \
@@ -83,7 +92,12 @@ HEADERS += \
         RangeSlider.H \
         SpinSlider.H \
         SpinRangeSlider.H \
-        PreferencesDialog.H
+        PreferencesDialog.H \
+        ModuleCache.H \
+        LogModel.H \
+        Telemetry.H \
+        Stats.H \
+        Fleet.H
         
 #        VideoWidget.H
 